@@ -41,6 +41,7 @@ typedef enum
 FILE* source; /* source code text file */
 FILE* listing; /* listing output text file */
 FILE* code; /* code text file for TM simulator */
+FILE* lines; /* line table file (see LineTable) */
 
 extern int lineno; /* source line number for listing */
 
@@ -71,6 +72,11 @@ typedef struct treeNode
      ExpType variableDataType;
      ExpType expressionType;
      int isParameter;
+     int isGlobal;     /* declared at file scope (see markGlobals) */
+     int isUsed;       /* file-scope declaration reached from main
+                          (see optimizeTree) */
+     int memloc;       /* data offset of a variable, or code address
+                          of a function, assigned by the code generator */
      struct treeNode* declaration;
      /* for type checking of exps */
    } TreeNode;
@@ -117,6 +123,52 @@ extern int TraceAnalyze;
  */
 extern int TraceCode;
 
+/* Optimize = TRUE runs the AST optimizer between
+ * type checking and code generation; set it to
+ * FALSE to debug the straight translation
+ */
+extern int Optimize;
+
+/* UseIR = TRUE generates the code of functions
+ * through the SSA intermediate representation
+ * (ir.c, iropt.c, irgen.c) instead of directly
+ * from the syntax tree
+ */
+extern int UseIR;
+
+/* TraceIR = TRUE prints the IR of each function
+ * to the listing file, before and after the IR
+ * passes
+ */
+extern int TraceIR;
+
+/* BinaryCode = TRUE writes the program as a TM
+ * object file (.tmo, see code.h) instead of
+ * TM text (.tm)
+ */
+extern int BinaryCode;
+
+/* TargetX86 = TRUE writes x86-64 assembly (.s,
+ * see x86gen.c) instead of TM code
+ */
+extern int TargetX86;
+
+/* LineTable = TRUE also writes a line table (.tml,
+ * see code.h) next to TM code, which maps code
+ * locations to source lines and functions for the
+ * profiler of tm.c
+ */
+extern int LineTable;
+
+/* CheckBounds = TRUE checks every array index
+ * against the array length; arrays then carry
+ * their length in the word before element 0, and
+ * a failed check stops TM with a data memory
+ * fault. Checks the IR passes prove safe are left
+ * out. Only the IR code generator checks.
+ */
+extern int CheckBounds;
+
 /* Error = TRUE prevents further passes if an error occurs */
 extern _Bool Error;
 #endif